@@ -38,6 +38,7 @@ SOURCES      := AS_global.C \
                 AS_UTL/bitPackedFile.C \
                 AS_UTL/bitPackedArray.C \
                 AS_UTL/dnaAlphabets.C \
+                AS_UTL/gzipFile.C \
                 AS_UTL/hexDump.C \
                 AS_UTL/md5.C \
                 AS_UTL/mt19937ar.C \
@@ -54,9 +55,11 @@ SOURCES      := AS_global.C \
                 \
                 stores/gkStore.C \
                 stores/gkStoreEncode.C \
+                stores/gkStoreBlobs.C \
                 \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
+                stores/ovStoreReader.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
@@ -81,6 +84,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/Display_Alignment.C \
                 overlapInCore/liboverlap/prefixEditDistance.C \
                 overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
+                overlapInCore/liboverlap/prefixEditDistance-bitVector.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
@@ -104,10 +108,12 @@ SOURCES      := AS_global.C \
                 utgcns/libcns/abAbacus-refine.C \
                 utgcns/libcns/abAbacus-refreshMultiAlign.C \
                 utgcns/libcns/abAbacus.C \
+                utgcns/libcns/abArena.C \
                 utgcns/libcns/abColumn.C \
                 utgcns/libcns/abMultiAlign.C \
                 utgcns/libcns/unitigConsensus.C \
                 utgcns/libpbutgcns/AlnGraphBoost.C  \
+                utgcns/libpbutgcns/AlnGraph.C  \
                 \
                 gfa/gfa.C \
                 gfa/bed.C \
@@ -168,6 +174,7 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
                 stores/ovStoreIndexer.mk \
+                stores/ovStoreConvert.mk \
                 stores/ovStoreDump.mk \
                 stores/ovStoreStats.mk \
                 stores/tgStoreCompress.mk \
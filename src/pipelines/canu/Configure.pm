@@ -417,6 +417,7 @@ sub getAllowedResources ($$$$@) {
     elsif ($alg eq "ovs")      {  $nam = "(overlap store sorting)"; }
     elsif ($alg eq "red")      {  $nam = "(read error detection)"; }
     elsif ($alg eq "oea")      {  $nam = "(overlap error adjustment)"; }
+    elsif ($alg eq "obt")      {  $nam = "(overlap based trimming)"; }
     elsif ($alg eq "bat")      {  $nam = "(contig construction)"; }
     elsif ($alg eq "cns")      {  $nam = "(consensus)"; }
     elsif ($alg eq "gfa")      {  $nam = "(GFA alignment and processing)"; }
@@ -703,6 +704,18 @@ sub configureAssembler () {
         setGlobalIfUndef("oeaMemory",   "4");       setGlobalIfUndef("oeaThreads",   "1");
     }
 
+    #  Overlap based trimming is run in the canu process itself.
+
+    if      (getGlobal("genomeSize") < adjustGenomeSize("40m")) {
+        setGlobalIfUndef("obtMemory",   "2-8");         setGlobalIfUndef("obtThreads",   "1-4");
+
+    } elsif (getGlobal("genomeSize") < adjustGenomeSize("500m")) {
+        setGlobalIfUndef("obtMemory",   "4-8");         setGlobalIfUndef("obtThreads",   "2-8");
+
+    } else {
+        setGlobalIfUndef("obtMemory",   "8-16");        setGlobalIfUndef("obtThreads",   "4-16");
+    }
+
     #  And bogart and GFA alignment/processing.
     #
     #  GFA for genomes less than 40m is run in the canu process itself.
@@ -763,6 +776,8 @@ sub configureAssembler () {
     ($err, $all) = getAllowedResources("",    "red",      $err, $all);
     ($err, $all) = getAllowedResources("",    "oea",      $err, $all);
 
+    ($err, $all) = getAllowedResources("",    "obt",      $err, $all);
+
     ($err, $all) = getAllowedResources("",    "bat",      $err, $all);
 
     ($err, $all) = getAllowedResources("",    "cns",      $err, $all);
@@ -107,6 +107,7 @@ sub utgcns ($$$) {
     print F "  -e " . getGlobal("cnsErrorRate") . " \\\n";
     print F "  -quick \\\n"      if (getGlobal("cnsConsensus") eq "quick");
     print F "  -pbdagcon \\\n"   if (getGlobal("cnsConsensus") eq "pbdagcon");
+    print F "  -window " . getGlobal("cnsWindowSize") . " \\\n"   if (getGlobal("cnsWindowSize") > 0);
     print F "  -edlib    \\\n"   if (getGlobal("canuIteration") >= 0);
     print F "  -utgcns \\\n"     if (getGlobal("cnsConsensus") eq "utgcns");
     print F "  -threads " . getGlobal("cnsThreads") . " \\\n";
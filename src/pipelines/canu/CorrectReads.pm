@@ -506,6 +506,8 @@ sub generateCorrectedReadsConfigure ($) {
     print F "  -b \$bgn -e \$end -r ./$asm.readsToCorrect \\\n"     if (  -e "$path/$asm.readsToCorrect");
     print F "  -b \$bgn -e \$end \\\n"                              if (! -e "$path/$asm.readsToCorrect");
     print F "  -t  " . getGlobal("corThreads") . " \\\n";
+    print F "  -M  " . getGlobal("corMemory") . " \\\n";
+    print F "  -Mc " . int(getGlobal("corMemory") * 100 / 8) / 100 . " \\\n";
     print F "  -ci " . getCorIdentity($asm) . "\\\n";
     print F "  -cl " . getGlobal("minReadLength") . "\\\n";
     print F "  -cc " . getGlobal("corMinCoverage") . " \\\n";
@@ -849,6 +849,8 @@ sub setDefaults () {
     setExecDefaults("red",     "read error detection");
     setExecDefaults("oea",     "overlap error adjustment");
 
+    setExecDefaults("obt",     "overlap based trimming");
+
     setExecDefaults("bat",     "unitig construction");
     setExecDefaults("cns",     "unitig consensus");
     setExecDefaults("gfa",     "graph alignment and processing");
@@ -908,6 +910,7 @@ sub setDefaults () {
     setDefault("cnsPartitions",   undef,       "Partition consensus into N jobs");
     setDefault("cnsPartitionMin", undef,       "Don't make a consensus partition with fewer than N reads");
     setDefault("cnsMaxCoverage",  40,          "Limit unitig consensus to at most this coverage; default '0' = unlimited");
+    setDefault("cnsWindowSize",   0,           "For pbdagcon, compute consensus of tigs longer than this in windows of this size; default '0' = whole tig");
     setDefault("cnsConsensus",    "pbdagcon",  "Which consensus algorithm to use; 'pbdagcon' (fast, reliable); 'utgcns' (multialignment output); 'quick' (single read mosaic); default 'pbdagcon'");
 
     #####  Correction Options